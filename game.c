@@ -0,0 +1,363 @@
+#include <stdio.h>
+#include <math.h>
+#include "game.h"
+
+// same as raylib's CheckCollisionCircleRec, kept here so the headless build
+// doesnt have to link raylib
+static bool CircleTouchesRec(Vector2 center, float radius, Rectangle rec)
+{
+    float dx = fabsf(center.x - (rec.x + rec.width / 2.0f));
+    float dy = fabsf(center.y - (rec.y + rec.height / 2.0f));
+
+    if (dx > (rec.width / 2.0f + radius))
+        return false;
+    if (dy > (rec.height / 2.0f + radius))
+        return false;
+    if (dx <= (rec.width / 2.0f))
+        return true;
+    if (dy <= (rec.height / 2.0f))
+        return true;
+
+    float cornerX = dx - rec.width / 2.0f;
+    float cornerY = dy - rec.height / 2.0f;
+    return cornerX * cornerX + cornerY * cornerY <= radius * radius;
+}
+
+void PlayerInteractDoor(World *world, Player *player, float delta, EnvItem *item)
+{
+    if (player->keys >= item->opt1 && !item->isDoorOpen)
+    {
+        player->keys = player->keys - item->opt1;
+        item->isDoorOpen = true;
+    }
+
+    if (item->isDoorOpen)
+    {
+        // we are about to goto a diffrent level!
+        ChangeLevel(world, item->opt2);
+
+        // move the player to the doors location
+        player->position = (Vector2){item->rect.x, item->rect.y};
+    }
+}
+
+void PlayerTouchedDoor(World *world, Player *player, float delta, EnvItem *item)
+{
+    if (item->isDoorOpen)
+    {
+        AddRenderEvent(world, STR_PRESS_USE_TO_ENTER, item);
+    }
+    else if (item->opt1 == 1)
+    {
+        AddRenderEvent(world, STR_DOOR_TAKES_ONE_KEY, item);
+    }
+    else if (item->opt1 == 2)
+    {
+        AddRenderEvent(world, STR_DOOR_TAKES_TWO_KEY, item);
+    }
+    else if (item->opt1 == 3)
+    {
+        AddRenderEvent(world, STR_DOOR_TAKES_THREE_KEY, item);
+    }
+}
+
+void PlayerTouchedKey(World *world, Player *player, float delta, EnvItem *item)
+{
+    if (item->isKeyTaken)
+        return; // player walked over where the key was
+    if (world->verbose)
+        printf("Touched item: %s \n", item->dbgname);
+    item->isKeyTaken = true;
+    item->textureId = -1.0f;
+    item->color = BLANK;
+    player->keys++;
+}
+// ------
+
+// -------------------  LEVELS -----------------
+// Convert tile tiles to px
+#define TW(x) \
+    (x * 16)
+
+// Convert tile tiles to px
+#define TH(x) \
+    (x * 16)
+
+// Convert tile tiles to px
+#define TX(x) \
+    (x * 16)
+
+// Convert tile tiles to px
+#define TY(x) \
+    (x * 16)
+
+// xy to flat index, 26 tiles per col
+#define TSS(x, y) ((x) + ((y) * (TILE_SHEET_COLS)))
+// clang-format off
+
+    /*
+     * Texture
+     *   -1 : use color 
+     * 
+     * Gravity
+     *   -1 : solid
+    */
+
+#define ONEKEY (1)
+#define TWOKEY (2)
+#define THREKY (3)
+
+ const int 
+    LEVEL1_Idx = 0,
+    LEVEL2_Idx = 1
+;
+
+const EnvItem level1[] = {
+/*dbg   x      y  width   height    SOLID       COLOR  TEXTUREID    W H    GRAVITY   PlayerTouchCallback     PlayerInteractedWithCallback opt1, opt2, opt3   opt4*/
+{  "bg",{0,     0, TW(75), TW(25)}, 0, {27,24,24,255},         -1,  1,1,       -1,  (EnvItemCallback*)NULL, (EnvItemCallback*)NULL,      0,    0,    0,     0},
+{    "",{TX(0),  TY(20), TW(330), TH(75)}, 1,           GRAY,  TSS(0,16),  1,1,       -1,  (EnvItemCallback*)NULL, (EnvItemCallback*)NULL,      0,    0,    0,     0},
+{    "",{TX(18), TY(13), TW(25),  TH(1)}, 1,           GRAY,  TSS(2, 2),  1,1,       -1,  (EnvItemCallback*)NULL, (EnvItemCallback*)NULL,      0,    0,    0,     0},
+{ "key",{TX(32), TY(18),  TW(1),  TW(1)}, 0,         YELLOW, TSS(7, 11),  1,1,     1000,        PlayerTouchedKey, (EnvItemCallback*)NULL,      0,    0,    0,     0},
+{"door",{TX(20), TY(11),  TW(1),  TH(2)}, 0,            RED, TSS(10,16),  1,2,       -1,       PlayerTouchedDoor,     PlayerInteractDoor, ONEKEY,    LEVEL2_Idx,    0,     0}
+};
+
+
+const EnvItem level2[] = {
+/*dbg   x      y  width   height    SOLID COLOR TEXTUREID    W H    GRAVITY   PlayerTouchCallback     PlayerInteractedWithCallback opt1,    opt2, opt3     opt4*/
+{    "",{0,   400, TW(75), TW(15)}, 1,    GRAY,  TSS(0,16),  1,1,       -1,  (EnvItemCallback*)NULL, (EnvItemCallback*)NULL,            0,    0,    0,      0},
+{    "",{300, 200, TW(25),  TW(1)}, 1,    GRAY,  TSS(2, 2),  1,1,       -1,  (EnvItemCallback*)NULL, (EnvItemCallback*)NULL,            0,    0,    0,      0},
+{    "",{315,  20, TW(25),  TW(1)}, 1,    GRAY,  TSS(2, 2),  1,1,       -1,  (EnvItemCallback*)NULL, (EnvItemCallback*)NULL,            0,    0,    0,      0},
+{    "",{250, 300,  TW(6),  TW(1)}, 1,    GRAY,          2,  1,1,       -1,  (EnvItemCallback*)NULL, (EnvItemCallback*)NULL,            0,    0,    0,      0},
+{    "",{650, 300,  TW(6),  TW(1)}, 1,    GRAY,          2,  1,1,       -1,  (EnvItemCallback*)NULL, (EnvItemCallback*)NULL,            0,    0,    0,      0},
+{ "key",{500, 300,  TW(1),  TW(1)}, 0,  YELLOW, TSS(7, 11),  1,1,     1000,        PlayerTouchedKey, (EnvItemCallback*)NULL,            0,    0,    0,      0},
+{ "key",{520, 300,  TW(1),  TW(1)}, 0,  YELLOW, TSS(7, 11),  1,1,     1000,        PlayerTouchedKey, (EnvItemCallback*)NULL,            0,    0,    0,      0},
+{"door",{540, 168,  TW(1),  TW(2)}, 0,     RED, TSS(10,16),  1,2,       -1,       PlayerTouchedDoor,     PlayerInteractDoor,       TWOKEY,    LEVEL1_Idx,    0,      0}
+};
+
+
+const int levelLens[]={
+    (int) (sizeof(level1) / sizeof(level1[0])),
+    (int) (sizeof(level2) / sizeof(level2[0])),
+};
+
+const EnvItem *levels[]={
+    level1,
+    level2
+};
+
+#define LEVEL_COUNT ((int)(sizeof(levels) / sizeof(levels[0])))
+
+// clang-format on
+
+#undef TSS
+#undef TW
+#undef TH
+#undef TX
+#undef TY
+
+_Static_assert(sizeof(level1) / sizeof(level1[0]) + sizeof(level2) / sizeof(level2[0]) <= WORLD_ITEMS_MAX,
+               "levels dont fit in World.items, bump WORLD_ITEMS_MAX");
+
+//--- world state, one per running game
+
+void AddRenderEvent(World *world, ESTRINGS message, EnvItem *item)
+{
+    RenderEvents *events = world->events;
+    if (events == NULL || events->count >= RENDER_EVENTS_MAX)
+        return; // drop it
+    events->events[events->count] = (struct RenderEvent){message, (int)(item - world->items)};
+    events->count++;
+}
+
+void InitWorld(World *world)
+{
+    RenderEvents *events = world->events;
+    bool verbose = world->verbose;
+    *world = (World){0};
+    world->events = events;
+    world->verbose = verbose;
+
+    int at = 0;
+    for (int l = 0; l < LEVEL_COUNT; l++)
+    {
+        for (int i = 0; i < levelLens[l]; i++)
+            world->items[at + i] = levels[l][i];
+        at += levelLens[l];
+    }
+
+    ChangeLevel(world, LEVEL1_Idx);
+}
+
+void InitPlayer(Player *player)
+{
+    *player = (Player){0};
+    player->position = (Vector2){PLAYER_START_X, PLAYER_START_Y};
+    player->speed = 0;
+    player->canJump = false;
+    player->direction = DIRECTION_RIGHT;
+}
+
+int WorldItemCount(void)
+{
+    int count = 0;
+    for (int l = 0; l < LEVEL_COUNT; l++)
+        count += levelLens[l];
+    return count;
+}
+
+int WorldItemLevel(int itemIdx)
+{
+    for (int l = 0; l < LEVEL_COUNT; l++)
+    {
+        if (itemIdx < levelLens[l])
+            return l;
+        itemIdx -= levelLens[l];
+    }
+    return -1;
+}
+
+void ChangeLevel(World *world, int newLevelIdx)
+{
+    if (world->verbose)
+        printf("changing to level %d\n", newLevelIdx);
+
+    int start = 0;
+    for (int l = 0; l < newLevelIdx; l++)
+        start += levelLens[l];
+
+    world->envItemsStart = start;
+    world->envItemsLength = levelLens[newLevelIdx];
+    world->levelIdx = newLevelIdx;
+
+    if (world->verbose)
+        printf("done changing to level %d\n", newLevelIdx);
+}
+//---
+
+void UpdateWorld(World *world, Player *player, float delta)
+{
+    EnvItem *envItems = WorldItems(world);
+    int envItemsLength = world->envItemsLength;
+
+    for (size_t i = 0; i < envItemsLength; i++)
+    {
+        // This item has gravity
+        if (envItems[i].gravity != -1.0f)
+        {
+            bool hitObstacle = false;
+            for (int j = 0; j < envItemsLength; j++)
+            {
+                EnvItem *ei = envItems + j;
+                Vector2 p = (Vector2){envItems[i].rect.x, envItems[i].rect.y};
+
+                if (ei->blocking &&
+                    ei->rect.x <= p.x &&
+                    ei->rect.x + ei->rect.width >= p.x &&
+                    ei->rect.y - 16 >= p.y &&
+                    ei->rect.y - 16 <= p.y + envItems[i].currFallSpeed * delta)
+                {
+                    hitObstacle = true;
+                    envItems[i].currFallSpeed = 0.0f;
+                    envItems[i].rect.y = ei->rect.y - 16;
+                    break;
+                }
+            }
+
+            if (!hitObstacle)
+            {
+                envItems[i].rect.y += envItems[i].currFallSpeed * delta;
+                envItems[i].currFallSpeed += envItems[i].gravity * delta;
+            }
+        }
+
+        // this item cares is player touches it
+        if (envItems[i].touch != NULL)
+        {
+            if (CircleTouchesRec(player->position, 2.0f, envItems[i].rect))
+            {
+                envItems[i].touch(world, player, delta, &envItems[i]);
+            }
+        }
+    }
+}
+
+void UpdatePlayer(World *world, Player *player, PlayerInput input, float delta)
+{
+    EnvItem *envItems = WorldItems(world);
+    int envItemsLength = world->envItemsLength;
+
+    // walking anamation update
+    if (input.left || input.right)
+    {
+        player->anamationTime++;
+        if (player->anamationTime > 5)
+        {
+            player->anamationIdx++;
+            player->anamationTime = 0;
+            if (player->anamationIdx >= 8)
+            {
+                player->anamationIdx = 0;
+            }
+        }
+    }
+    else
+        player->anamationIdx = 0;
+
+    if (input.left)
+    {
+        player->position.x -= PLAYER_HOR_SPD * delta;
+        player->direction = DIRECTION_LEFT;
+    }
+    if (input.right)
+    {
+        player->position.x += PLAYER_HOR_SPD * delta;
+        player->direction = DIRECTION_RIGHT;
+    }
+    if (input.jump && player->canJump)
+    {
+        player->speed = -PLAYER_JUMP_SPD;
+        player->canJump = false;
+    }
+
+    if (input.use && player->canJump)
+    {
+        for (int i = 0; i < envItemsLength; i++)
+        {
+            if (CircleTouchesRec(player->position, 2, envItems[i].rect))
+            {
+                if (envItems[i].interact != NULL)
+                {
+                    envItems[i].interact(world, player, delta, &envItems[i]);
+                    break;
+                }
+            }
+        }
+    }
+
+    bool hitObstacle = false;
+    for (int i = 0; i < envItemsLength; i++)
+    {
+        EnvItem *ei = envItems + i;
+        Vector2 *p = &(player->position);
+        if (ei->blocking &&
+            ei->rect.x <= p->x &&
+            ei->rect.x + ei->rect.width >= p->x &&
+            ei->rect.y >= p->y &&
+            ei->rect.y <= p->y + player->speed * delta)
+        {
+            hitObstacle = true;
+            player->speed = 0.0f;
+            p->y = ei->rect.y;
+            break;
+        }
+    }
+
+    if (!hitObstacle)
+    {
+        player->position.y += player->speed * delta;
+        player->speed += G * delta;
+        player->canJump = false;
+    }
+    else
+        player->canJump = true;
+}
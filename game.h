@@ -0,0 +1,142 @@
+#ifndef GAME_H
+#define GAME_H
+
+// Game simulation: player, level items and everything that moves them.
+// Nothing in here opens a window, draws or reads the keyboard, so it can be
+// run headless (see sim.h) as well as by main.c. Only raylib's types are
+// used, not the library.
+
+#include <stdbool.h>
+#include "raylib.h"
+
+#define G 800
+#define PLAYER_JUMP_SPD 450.0f
+#define PLAYER_HOR_SPD 200.0f
+
+#define PLAYER_START_X (400)
+#define PLAYER_START_Y (280)
+
+// tile sheet layout, textureId is col + row * TILE_SHEET_COLS
+#define TILE_SHEET_SPRITE_SIZE (8)
+#define TILE_SHEET_COLS (26)
+#define TILE_SHEET_ROWS (19)
+
+// enough for every level back to back, see levelLens in game.c
+#define WORLD_ITEMS_MAX (16)
+#define RENDER_EVENTS_MAX (128)
+
+enum
+{
+    DIRECTION_LEFT,
+    DIRECTION_RIGHT
+};
+
+typedef struct Player
+{
+    int keys;
+    Vector2 position;
+    float speed;
+    bool canJump;
+
+    int direction;
+    int anamationIdx;
+    int anamationTime;
+} Player;
+
+// what the player wants to do this frame, main fills this from the keyboard
+typedef struct PlayerInput
+{
+    bool left, right, jump;
+    bool use; // only for the frame use was pressed
+} PlayerInput;
+
+struct EnvItem;
+struct World;
+
+// when player touches item     the world the item is in         player that touched         the item that was touched
+typedef void (*EnvItemCallback)(struct World *world, struct Player *player, float delta, struct EnvItem *item);
+
+typedef struct EnvItem
+{
+    const char *dbgname;
+    Rectangle rect;
+    int blocking;
+    Color color;
+    int textureId,
+        textureTilesWide,
+        textureTilesTall;
+
+    int gravity;
+    EnvItemCallback
+        touch,
+        interact;
+
+    // things not everything may use ------
+    int opt1, opt2, opt3, opt4;
+
+    // process vars for things -- dont set in ctor
+    float currFallSpeed;
+    bool isKeyTaken;
+    bool isDoorOpen;
+} EnvItem;
+
+// ---- update logic events
+// what the update wants shown, main.c maps these to strings and draw calls
+typedef enum ESTRINGS
+{
+    STR_DOOR_TAKES_ONE_KEY,
+    STR_DOOR_TAKES_TWO_KEY,
+    STR_DOOR_TAKES_THREE_KEY,
+    STR_PRESS_USE_TO_ENTER
+} ESTRINGS;
+
+struct RenderEvent
+{
+    ESTRINGS message;
+    int itemIdx; // into World.items
+};
+
+// filled during update, drawn and cleared by whoever renders
+typedef struct RenderEvents
+{
+    struct RenderEvent events[RENDER_EVENTS_MAX];
+    int count;
+} RenderEvents;
+
+// One running copy of the game. Every level is copied into items so keys
+// and doors stay how the player left them, the current level is the
+// envItemsLength items starting at envItemsStart. Only offsets and indices
+// are kept so a World can be copied or moved around freely, copies share
+// the same events.
+typedef struct World
+{
+    EnvItem items[WORLD_ITEMS_MAX];
+    int envItemsStart;
+    int envItemsLength;
+    int levelIdx;
+
+    RenderEvents *events; // NULL when nothing is drawn, events are dropped
+    bool verbose;         // printf what is going on
+} World;
+
+//----------------------------------------------------------------------------------
+// Module functions declaration
+//----------------------------------------------------------------------------------
+void InitWorld(World *world);
+void InitPlayer(Player *player);
+void ChangeLevel(World *world, int nextLevelIdx);
+void AddRenderEvent(World *world, ESTRINGS message, EnvItem *item);
+
+// how many of World.items InitWorld fills, and which level each one is in
+int WorldItemCount(void);
+int WorldItemLevel(int itemIdx);
+
+static inline EnvItem *WorldItems(World *world)
+{
+    return world->items + world->envItemsStart;
+}
+
+void UpdatePlayer(World *world, Player *player, PlayerInput input, float delta);
+void UpdateWorld(World *world, Player *player, float delta);
+
+#endif
@@ -17,24 +17,16 @@
 #include <stdio.h>
 #include "raylib.h"
 #include "raymath.h"
+#include "game.h"
 
-#define G 800
-#define PLAYER_JUMP_SPD 450.0f
-#define PLAYER_HOR_SPD 200.0f
-
-enum
-{
-    DIRECTION_LEFT,
-    DIRECTION_RIGHT
-};
-
-typedef enum ESTRINGS
-{
-    STR_DOOR_TAKES_ONE_KEY,
-    STR_DOOR_TAKES_TWO_KEY,
-    STR_DOOR_TAKES_THREE_KEY,
-    STR_PRESS_USE_TO_ENTER
-} ESTRINGS;
+//----------------------------------------------------------------------------------
+// Module functions declaration
+//----------------------------------------------------------------------------------
+void UpdateCameraCenter(Camera2D *camera, Player *player, EnvItem *envItems, int envItemsLength, float delta, int width, int height);
+void UpdateCameraCenterInsideMap(Camera2D *camera, Player *player, EnvItem *envItems, int envItemsLength, float delta, int width, int height);
+void UpdateCameraCenterSmoothFollow(Camera2D *camera, Player *player, EnvItem *envItems, int envItemsLength, float delta, int width, int height);
+void UpdateCameraEvenOutOnLanding(Camera2D *camera, Player *player, EnvItem *envItems, int envItemsLength, float delta, int width, int height);
+void UpdateCameraPlayerBoundsPush(Camera2D *camera, Player *player, EnvItem *envItems, int envItemsLength, float delta, int width, int height);
 
 // clang-format off
 static const char *GetString(enum ESTRINGS str){switch (str){ 
@@ -46,82 +38,9 @@ static const char *GetString(enum ESTRINGS str){switch (str){
 }}
 // clang-format on
 
-typedef struct Player
-{
-    int keys;
-    Vector2 position;
-    float speed;
-    bool canJump;
-
-    int direction;
-    int anamationIdx;
-    int anamationTime;
-} Player;
-
-typedef struct EnvItem;
-
-// when player touches item     all items in env                        player that touched         the item that was touched
-typedef void (*EnvItemCallback)(struct EnvItem *items, int itemsLen, struct Player *player, float delta, struct EnvItem *item);
-
-typedef struct EnvItem
-{
-    const char *dbgname;
-    Rectangle rect;
-    int blocking;
-    Color color;
-    int textureId,
-        textureTilesWide,
-        textureTilesTall;
-
-    int gravity;
-    EnvItemCallback
-        touch,
-        interact;
-
-    // things not everything may use ------
-    int opt1, opt2, opt3, opt4;
-
-    // process vars for things -- dont set in ctor
-    float currFallSpeed;
-    bool isKeyTaken;
-    bool isDoorOpen;
-} EnvItem;
-
-//----------------------------------------------------------------------------------
-// Module functions declaration
-//----------------------------------------------------------------------------------
-void UpdatePlayer(Player *player, EnvItem *envItems, int envItemsLength, float delta);
-void UpdateWorld(Player *player, EnvItem *envItems, int envItemsLength, float delta);
-void UpdateCameraCenter(Camera2D *camera, Player *player, EnvItem *envItems, int envItemsLength, float delta, int width, int height);
-void UpdateCameraCenterInsideMap(Camera2D *camera, Player *player, EnvItem *envItems, int envItemsLength, float delta, int width, int height);
-void UpdateCameraCenterSmoothFollow(Camera2D *camera, Player *player, EnvItem *envItems, int envItemsLength, float delta, int width, int height);
-void UpdateCameraEvenOutOnLanding(Camera2D *camera, Player *player, EnvItem *envItems, int envItemsLength, float delta, int width, int height);
-void UpdateCameraPlayerBoundsPush(Camera2D *camera, Player *player, EnvItem *envItems, int envItemsLength, float delta, int width, int height);
-
-// ---- update logic events
+// ---- drawing for update logic events
 typedef void(RenderMethod(EnvItem *items, int itemsLen, Player *player, EnvItem *item, void *tag));
 
-void AddRenderEvent(RenderMethod renderMethod, Player *player, EnvItem *item, void *tag);
-void ChangeLevel(int nextLevelIdx);
-
-void PlayerInteractDoor(EnvItem *items, int itemsLen, Player *player, float delta, EnvItem *item)
-{
-    if (player->keys >= item->opt1 && !item->isDoorOpen)
-    {
-        player->keys = player->keys - item->opt1;
-        item->isDoorOpen = true;
-    }
-
-    if (item->isDoorOpen)
-    {
-        // we are about to goto a diffrent level!
-        ChangeLevel(item->opt2);
-
-        // move the player to the doors location
-        player->position = (Vector2){item->rect.x, item->rect.y};
-    }
-}
-
 // tag is message
 void DoorKeyMessageRenderMethod(EnvItem *items, int itemsLen, Player *player, EnvItem *item, void *tag)
 {
@@ -130,148 +49,87 @@ void DoorKeyMessageRenderMethod(EnvItem *items, int itemsLen, Player *player, En
     DrawText(msg, item->rect.x, item->rect.y - 32 + 12, 12, WHITE);
 }
 
-void PlayerTouchedDoor(EnvItem *items, int itemsLen, Player *player, float delta, EnvItem *item)
+// which draw method shows a given event
+RenderMethod *GetRenderMethod(ESTRINGS message)
 {
-    if (item->isDoorOpen)
+    switch (message)
     {
-        AddRenderEvent(DoorKeyMessageRenderMethod, player, item, (void *)GetString(STR_PRESS_USE_TO_ENTER));
+    case STR_DOOR_TAKES_ONE_KEY:
+    case STR_DOOR_TAKES_TWO_KEY:
+    case STR_DOOR_TAKES_THREE_KEY:
+    case STR_PRESS_USE_TO_ENTER:
+        return DoorKeyMessageRenderMethod;
+    default:
+        return NULL;
     }
-    else if (item->opt1 == 1)
-    {
-        AddRenderEvent(DoorKeyMessageRenderMethod, player, item, (void *)GetString(STR_DOOR_TAKES_ONE_KEY));
-    }
-    else if (item->opt1 == 2)
-    {
-        AddRenderEvent(DoorKeyMessageRenderMethod, player, item, (void *)GetString(STR_DOOR_TAKES_TWO_KEY));
-    }
-    else if (item->opt1 == 3)
-    {
-        AddRenderEvent(DoorKeyMessageRenderMethod, player, item, (void *)GetString(STR_DOOR_TAKES_THREE_KEY));
-    }
-}
-
-void PlayerTouchedKey(EnvItem *items, int itemsLen, Player *player, float delta, EnvItem *item)
-{
-    if (item->isKeyTaken)
-        return; // player walked over where the key was
-    printf("Touched item: %s \n", item->dbgname);
-    item->isKeyTaken = true;
-    item->textureId = -1.0f;
-    item->color = BLANK;
-    player->keys++;
 }
-// ------
-//--- global state not held within main >.<
 
-struct RenderEvent
+// ------------------- LEVEL OF DETAIL -----------------
+// When zoomed out a 16px tile ends up only a few pixels wide on screen, so
+// drawing every tile is a lot of tiny quads. Below LOD_TILE_FULL_PX we fade
+// the tiles out into one solid rectangle per item, coloured with the
+// average of that tile's sprite, and below LOD_TILE_SOLID_PX only the
+// rectangle is drawn. The rectangle only starts fading once the tiles are
+// half in, so the background doesnt show through mid fade, and it is gone
+// by the time the tiles are fully in so see-through pixels dont pop.
+// Single tile items (keys) always draw as tiles, there is nothing to merge.
+#define LOD_TILE_FULL_PX (12.0f)
+#define LOD_TILE_SOLID_PX (6.0f)
+
+// average colour of every sprite in the sheet, indexed by textureId
+static Color tileLodColors[TILE_SHEET_COLS * TILE_SHEET_ROWS];
+
+void BuildTileLodColors(Image sheet, int spriteSize, int spritesPerRow, Color *colors, int colorsLen)
 {
-    RenderMethod *method;
-    Player *player;
-    EnvItem *item;
-    void *user_tag;
-} GSEVENTS[128] = {0};
-int GSEVENTSSTACKINDEX;
-
-void AddRenderEvent(RenderMethod renderMethod, Player *player, EnvItem *item, void *tag)
-{
-    if (GSEVENTSSTACKINDEX >= 128)
-        return; // drop it
-    GSEVENTS[GSEVENTSSTACKINDEX] = (struct RenderEvent){renderMethod, player, item, tag};
-    GSEVENTSSTACKINDEX++;
-}
-//---
-
-// -------------------  LEVELS -----------------
-const int tiles = 26;
-
-// Convert tile tiles to px
-#define TW(x) \
-    (x * 16)
+    int cols = sheet.width / spriteSize;
+    int rows = sheet.height / spriteSize;
+    if (cols > spritesPerRow)
+        cols = spritesPerRow;
 
-// Convert tile tiles to px
-#define TH(x) \
-    (x * 16)
-
-// Convert tile tiles to px
-#define TX(x) \
-    (x * 16)
-
-// Convert tile tiles to px
-#define TY(x) \
-    (x * 16)
-
-// xy to flat index, 26 tiles per col
-#define TSS(x, y) ((x) + ((y) * (tiles)))
-// clang-format off
-
-    /*
-     * Texture
-     *   -1 : use color 
-     * 
-     * Gravity
-     *   -1 : solid
-    */
-
-#define ONEKEY (1)
-#define TWOKEY (2)
-#define THREKY (3)
-
- const int 
-    LEVEL1_Idx = 0,
-    LEVEL2_Idx = 1
-;
-
-EnvItem level1[] = {
-/*dbg   x      y  width   height    SOLID       COLOR  TEXTUREID    W H    GRAVITY   PlayerTouchCallback     PlayerInteractedWithCallback opt1, opt2, opt3   opt4*/
-{  "bg",{0,     0, TW(75), TW(25)}, 0, {27,24,24,255},         -1,  1,1,       -1,  (EnvItemCallback*)NULL, (EnvItemCallback*)NULL,      0,    0,    0,     0},
-{    "",{TX(0),  TY(20), TW(330), TH(75)}, 1,           GRAY,  TSS(0,16),  1,1,       -1,  (EnvItemCallback*)NULL, (EnvItemCallback*)NULL,      0,    0,    0,     0},
-{    "",{TX(18), TY(13), TW(25),  TH(1)}, 1,           GRAY,  TSS(2, 2),  1,1,       -1,  (EnvItemCallback*)NULL, (EnvItemCallback*)NULL,      0,    0,    0,     0},
-{ "key",{TX(32), TY(18),  TW(1),  TW(1)}, 0,         YELLOW, TSS(7, 11),  1,1,     1000,        PlayerTouchedKey, (EnvItemCallback*)NULL,      0,    0,    0,     0},
-{"door",{TX(20), TY(11),  TW(1),  TH(2)}, 0,            RED, TSS(10,16),  1,2,       -1,       PlayerTouchedDoor,     PlayerInteractDoor, ONEKEY,    LEVEL2_Idx,    0,     0}
-};
-
-
-EnvItem level2[] = {
-/*dbg   x      y  width   height    SOLID COLOR TEXTUREID    W H    GRAVITY   PlayerTouchCallback     PlayerInteractedWithCallback opt1,    opt2, opt3     opt4*/
-{    "",{0,   400, TW(75), TW(15)}, 1,    GRAY,  TSS(0,16),  1,1,       -1,  (EnvItemCallback*)NULL, (EnvItemCallback*)NULL,            0,    0,    0,      0},
-{    "",{300, 200, TW(25),  TW(1)}, 1,    GRAY,  TSS(2, 2),  1,1,       -1,  (EnvItemCallback*)NULL, (EnvItemCallback*)NULL,            0,    0,    0,      0},
-{    "",{315,  20, TW(25),  TW(1)}, 1,    GRAY,  TSS(2, 2),  1,1,       -1,  (EnvItemCallback*)NULL, (EnvItemCallback*)NULL,            0,    0,    0,      0},
-{    "",{250, 300,  TW(6),  TW(1)}, 1,    GRAY,          2,  1,1,       -1,  (EnvItemCallback*)NULL, (EnvItemCallback*)NULL,            0,    0,    0,      0},
-{    "",{650, 300,  TW(6),  TW(1)}, 1,    GRAY,          2,  1,1,       -1,  (EnvItemCallback*)NULL, (EnvItemCallback*)NULL,            0,    0,    0,      0},
-{ "key",{500, 300,  TW(1),  TW(1)}, 0,  YELLOW, TSS(7, 11),  1,1,     1000,        PlayerTouchedKey, (EnvItemCallback*)NULL,            0,    0,    0,      0},
-{ "key",{520, 300,  TW(1),  TW(1)}, 0,  YELLOW, TSS(7, 11),  1,1,     1000,        PlayerTouchedKey, (EnvItemCallback*)NULL,            0,    0,    0,      0},
-{"door",{540, 168,  TW(1),  TW(2)}, 0,     RED, TSS(10,16),  1,2,       -1,       PlayerTouchedDoor,     PlayerInteractDoor,       TWOKEY,    LEVEL1_Idx,    0,      0}
-};
-
-
-const int levelLens[]={
-    (int) (sizeof(level1) / sizeof(level1[0])),
-    (int) (sizeof(level2) / sizeof(level2[0])),
-};
-
-const EnvItem* levels[]={
-    &level1,
-    &level2
-};
-
-// clang-format on
+    for (int ty = 0; ty < rows; ty++)
+    {
+        for (int tx = 0; tx < cols; tx++)
+        {
+            int idx = tx + ty * spritesPerRow;
+            if (idx >= colorsLen)
+                return; // sheet is bigger than we expected, rest stay BLANK
 
-#undef TSS
-#undef TW
-#undef TH
-#undef TX
-#undef TY
+            // weight by alpha so see-through pixels dont darken the tile
+            float r = 0, g = 0, b = 0, a = 0;
+            for (int y = 0; y < spriteSize; y++)
+            {
+                for (int x = 0; x < spriteSize; x++)
+                {
+                    Color c = GetImageColor(sheet, tx * spriteSize + x, ty * spriteSize + y);
+                    r += c.r * c.a;
+                    g += c.g * c.a;
+                    b += c.b * c.a;
+                    a += c.a;
+                }
+            }
 
-// --
+            Color avg = BLANK;
+            if (a > 0)
+            {
+                avg.r = (unsigned char)(r / a);
+                avg.g = (unsigned char)(g / a);
+                avg.b = (unsigned char)(b / a);
+                avg.a = (unsigned char)(a / (spriteSize * spriteSize));
+            }
+            colors[idx] = avg;
+        }
+    }
+}
 
-EnvItem *envItems;
-int envItemsLength;
-void ChangeLevel(int newLevelIdx)
+// 0 = draw the solid span only, 1 = draw the tiles only, between = fade
+float TileLodBlend(float tileSize, float zoom)
 {
-    printf("changing to level %d\n", newLevelIdx);
-    envItems = levels[newLevelIdx];
-    envItemsLength = levelLens[newLevelIdx];
-    printf("done changing to level %d\n", newLevelIdx);
+    float px = tileSize * zoom;
+    if (px >= LOD_TILE_FULL_PX)
+        return 1.0f;
+    if (px <= LOD_TILE_SOLID_PX)
+        return 0.0f;
+    return (px - LOD_TILE_SOLID_PX) / (LOD_TILE_FULL_PX - LOD_TILE_SOLID_PX);
 }
 
 //------------------------------------------------------------------------------------
@@ -283,28 +141,26 @@ int main(void)
     //--------------------------------------------------------------------------------------
     const int screenWidth = 800;
     const int screenHeight = 600;
-    GSEVENTSSTACKINDEX = 0;
 
-    ChangeLevel(0);
+    RenderEvents renderEvents = {0};
+    World world = {0};
+    world.events = &renderEvents;
+    world.verbose = true;
+    InitWorld(&world);
 
     InitWindow(screenWidth, screenHeight, "game");
-    Texture2D tilesTexture = LoadTexture("Tiles-and-EnemiesT.png");
+    Image tilesImage = LoadImage("Tiles-and-EnemiesT.png");
+    Texture2D tilesTexture = LoadTextureFromImage(tilesImage);
+    BuildTileLodColors(tilesImage, TILE_SHEET_SPRITE_SIZE, TILE_SHEET_COLS,
+                       tileLodColors, sizeof(tileLodColors) / sizeof(tileLodColors[0]));
+    UnloadImage(tilesImage);
 
-    printf("tiles w %d\n", tiles);
+    printf("tiles w %d\n", TILE_SHEET_COLS);
 
     Texture2D playerTexture = LoadTexture("PlayerT.png");
 
-    Player player = {0};
-    player.position = (Vector2){400, 280};
-    player.speed = 0;
-    player.canJump = false;
-    player.direction = DIRECTION_RIGHT;
-
-    for (size_t i = 0; i < envItemsLength; i++)
-    {
-        envItems[i].currFallSpeed = 0;
-        envItems[i].isDoorOpen = false;
-    }
+    Player player;
+    InitPlayer(&player);
 
     Camera2D camera = {0};
     camera.target = player.position;
@@ -324,8 +180,18 @@ int main(void)
         //----------------------------------------------------------------------------------
         float deltaTime = GetFrameTime();
 
-        UpdatePlayer(&player, envItems, envItemsLength, deltaTime);
-        UpdateWorld(&player, envItems, envItemsLength, deltaTime);
+        PlayerInput input = {0};
+        input.left = IsKeyDown(KEY_LEFT);
+        input.right = IsKeyDown(KEY_RIGHT);
+        input.jump = IsKeyDown(KEY_SPACE);
+        input.use = IsKeyPressed(KEY_ENTER);
+
+        UpdatePlayer(&world, &player, input, deltaTime);
+        UpdateWorld(&world, &player, deltaTime);
+
+        // level may have changed during the update
+        EnvItem *envItems = WorldItems(&world);
+        int envItemsLength = world.envItemsLength;
 
         camera.zoom += ((float)GetMouseWheelMove() * 0.05f);
 
@@ -337,8 +203,9 @@ int main(void)
         if (IsKeyPressed(KEY_R))
         {
             camera.zoom = 1.0f;
-            player.position = (Vector2){400, 280};
-            envItems[6].rect.y = 300;
+            player.position = (Vector2){PLAYER_START_X, PLAYER_START_Y};
+            if (envItemsLength > 6)
+                envItems[6].rect.y = 300;
         }
         if (IsKeyPressed(KEY_D))
         {
@@ -364,8 +231,8 @@ int main(void)
                 DrawRectangleRec(envItems[i].rect, envItems[i].color);
             else
             {
-                int tileSheetSpriteSize = 8;
-                const int sprites_per_row = 26;
+                int tileSheetSpriteSize = TILE_SHEET_SPRITE_SIZE;
+                const int sprites_per_row = TILE_SHEET_COLS;
 
                 int row = envItems[i].textureId / sprites_per_row;
                 int col = envItems[i].textureId % sprites_per_row;
@@ -402,10 +269,23 @@ int main(void)
                 }
                 else // everything else
                 {
-                    for (size_t tw = 0; tw < tilesWide; tw++)
+                    float lod = tilesWide > 1 ? TileLodBlend(tileSize, camera.zoom) : 1.0f;
+
+                    if (lod < 1.0f)
                     {
-                        drawingPos.x = tw * tileSize + envItems[i].rect.x;
-                        DrawTexturePro(tilesTexture, src, drawingPos, (Vector2){0, 0}, 0, WHITE);
+                        Rectangle span = {envItems[i].rect.x, envItems[i].rect.y, tilesWide * tileSize, tileSize};
+                        Color spanColor = tileLodColors[envItems[i].textureId];
+                        spanColor.a = (unsigned char)(spanColor.a * fminf(1.0f, 2.0f * (1.0f - lod)));
+                        DrawRectangleRec(span, spanColor);
+                    }
+
+                    if (lod > 0.0f)
+                    {
+                        for (size_t tw = 0; tw < tilesWide; tw++)
+                        {
+                            drawingPos.x = tw * tileSize + envItems[i].rect.x;
+                            DrawTexturePro(tilesTexture, src, drawingPos, (Vector2){0, 0}, 0, Fade(WHITE, lod));
+                        }
                     }
                 }
 
@@ -415,13 +295,15 @@ int main(void)
         }
 
         // draw events
-        for (size_t eidx = 0; eidx < GSEVENTSSTACKINDEX; eidx++)
+        for (size_t eidx = 0; eidx < renderEvents.count; eidx++)
         {
-            struct RenderEvent *rev = &GSEVENTS[eidx];
-            rev->method(envItems, envItemsLength, &player, rev->item, rev->user_tag);
+            struct RenderEvent *rev = &renderEvents.events[eidx];
+            RenderMethod *method = GetRenderMethod(rev->message);
+            if (method != NULL)
+                method(envItems, envItemsLength, &player, &world.items[rev->itemIdx], (void *)GetString(rev->message));
         }
 
-        GSEVENTSSTACKINDEX = 0;
+        renderEvents.count = 0;
 
         // draw player
         Rectangle playerRect = {player.position.x - 20, player.position.y - 40, 40.0f, 40.0f};
@@ -455,134 +337,14 @@ int main(void)
 
     // De-Initialization
     //--------------------------------------------------------------------------------------
+    UnloadTexture(tilesTexture);
+    UnloadTexture(playerTexture);
     CloseWindow(); // Close window and OpenGL context
     //--------------------------------------------------------------------------------------
 
     return 0;
 }
 
-void UpdateWorld(Player *player, EnvItem *envItems, int envItemsLength, float delta)
-{
-    for (size_t i = 0; i < envItemsLength; i++)
-    {
-        // This item has gravity
-        if (envItems[i].gravity != -1.0f)
-        {
-            bool hitObstacle = false;
-            for (int j = 0; j < envItemsLength; j++)
-            {
-                EnvItem *ei = envItems + j;
-                Vector2 p = (Vector2){envItems[i].rect.x, envItems[i].rect.y};
-
-                if (ei->blocking &&
-                    ei->rect.x <= p.x &&
-                    ei->rect.x + ei->rect.width >= p.x &&
-                    ei->rect.y - 16 >= p.y &&
-                    ei->rect.y - 16 <= p.y + envItems[i].currFallSpeed * delta)
-                {
-                    hitObstacle = true;
-                    envItems[i].currFallSpeed = 0.0f;
-                    envItems[i].rect.y = ei->rect.y - 16;
-                    break;
-                }
-            }
-
-            if (!hitObstacle)
-            {
-                envItems[i].rect.y += envItems[i].currFallSpeed * delta;
-                envItems[i].currFallSpeed += envItems[i].gravity * delta;
-            }
-        }
-
-        // this item cares is player touches it
-        if (envItems[i].touch != NULL)
-        {
-            if (CheckCollisionCircleRec(player->position, 2.0f, envItems[i].rect))
-            {
-                envItems[i].touch(envItems, envItemsLength, player, delta, &envItems[i]);
-            }
-        }
-    }
-}
-
-void UpdatePlayer(Player *player, EnvItem *envItems, int envItemsLength, float delta)
-{
-    // walking anamation update
-    if (IsKeyDown(KEY_LEFT) || IsKeyDown(KEY_RIGHT))
-    {
-        player->anamationTime++;
-        if (player->anamationTime > 5)
-        {
-            player->anamationIdx++;
-            player->anamationTime = 0;
-            if (player->anamationIdx >= 8)
-            {
-                player->anamationIdx = 0;
-            }
-        }
-    }
-    else
-        player->anamationIdx = 0;
-
-    if (IsKeyDown(KEY_LEFT))
-    {
-        player->position.x -= PLAYER_HOR_SPD * delta;
-        player->direction = DIRECTION_LEFT;
-    }
-    if (IsKeyDown(KEY_RIGHT))
-    {
-        player->position.x += PLAYER_HOR_SPD * delta;
-        player->direction = DIRECTION_RIGHT;
-    }
-    if (IsKeyDown(KEY_SPACE) && player->canJump)
-    {
-        player->speed = -PLAYER_JUMP_SPD;
-        player->canJump = false;
-    }
-
-    if (IsKeyPressed(KEY_ENTER) && player->canJump)
-    {
-        for (int i = 0; i < envItemsLength; i++)
-        {
-            if (CheckCollisionCircleRec(player->position, 2, envItems[i].rect))
-            {
-                if (envItems[i].interact != NULL)
-                {
-                    envItems[i].interact(envItems, envItemsLength, player, delta, &envItems[i]);
-                    break;
-                }
-            }
-        }
-    }
-
-    bool hitObstacle = false;
-    for (int i = 0; i < envItemsLength; i++)
-    {
-        EnvItem *ei = envItems + i;
-        Vector2 *p = &(player->position);
-        if (ei->blocking &&
-            ei->rect.x <= p->x &&
-            ei->rect.x + ei->rect.width >= p->x &&
-            ei->rect.y >= p->y &&
-            ei->rect.y <= p->y + player->speed * delta)
-        {
-            hitObstacle = true;
-            player->speed = 0.0f;
-            p->y = ei->rect.y;
-            break;
-        }
-    }
-
-    if (!hitObstacle)
-    {
-        player->position.y += player->speed * delta;
-        player->speed += G * delta;
-        player->canJump = false;
-    }
-    else
-        player->canJump = true;
-}
-
 void UpdateCameraCenter(Camera2D *camera, Player *player, EnvItem *envItems, int envItemsLength, float delta, int width, int height)
 {
     camera->offset = (Vector2){width / 2.0f, height / 2.0f};
@@ -0,0 +1,269 @@
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "game.h"
+#include "sim.h"
+
+// world.events stays NULL, so nothing is recorded for drawing
+typedef struct SimInstance
+{
+    Player player;
+    World world;
+} SimInstance;
+
+struct SimWorker
+{
+    SimBatch *batch;
+    pthread_t thread;
+    int first, count; // instances this worker owns
+};
+
+struct SimBatch
+{
+    SimInstance *instances;
+    int instanceCount;
+
+    // worker 0 is whoever calls SimBatchStep, the rest are threads that
+    // sleep on the start barrier between steps
+    struct SimWorker *workers;
+    int threadCount;
+    pthread_barrier_t start, done;
+    pthread_mutex_t setup; // held while the workers are being made
+    bool quit;
+
+    // the step being run, set before start is released
+    const unsigned char *inputs;
+    int ticks;
+    float delta;
+    SimState *states;
+};
+
+static PlayerInput SimDecodeInput(unsigned char bits)
+{
+    PlayerInput input = {0};
+    input.left = (bits & SIM_INPUT_LEFT) != 0;
+    input.right = (bits & SIM_INPUT_RIGHT) != 0;
+    input.jump = (bits & SIM_INPUT_JUMP) != 0;
+    input.use = (bits & SIM_INPUT_USE) != 0;
+    return input;
+}
+
+// instances dont share anything, so each one runs all of its ticks before
+// moving on to the next, keeping it hot in cache
+static void SimRunShard(SimBatch *batch, int first, int count)
+{
+    for (int i = first; i < first + count; i++)
+    {
+        SimInstance *inst = &batch->instances[i];
+
+        for (int t = 0; t < batch->ticks; t++)
+        {
+            PlayerInput input = SimDecodeInput(batch->inputs[(size_t)t * batch->instanceCount + i]);
+
+            UpdatePlayer(&inst->world, &inst->player, input, batch->delta);
+            UpdateWorld(&inst->world, &inst->player, batch->delta);
+        }
+
+        if (batch->states != NULL)
+        {
+            SimState *s = &batch->states[i];
+            s->x = inst->player.position.x;
+            s->y = inst->player.position.y;
+            s->speed = inst->player.speed;
+            s->canJump = inst->player.canJump;
+            s->keys = inst->player.keys;
+            s->level = inst->world.levelIdx;
+            s->direction = inst->player.direction;
+        }
+    }
+}
+
+static void *SimWorkerMain(void *arg)
+{
+    struct SimWorker *worker = arg;
+    SimBatch *batch = worker->batch; // set before we were started
+
+    // wait until the barriers are set up for however many of us got made,
+    // first/count and quit are only read after this
+    pthread_mutex_lock(&batch->setup);
+    pthread_mutex_unlock(&batch->setup);
+
+    if (batch->quit)
+        return NULL;
+
+    for (;;)
+    {
+        pthread_barrier_wait(&batch->start);
+        if (batch->quit)
+            break;
+        SimRunShard(batch, worker->first, worker->count);
+        pthread_barrier_wait(&batch->done);
+    }
+
+    return NULL;
+}
+
+SimBatch *SimBatchCreate(int instanceCount, int threadCount)
+{
+    if (instanceCount <= 0)
+        return NULL;
+
+    if (threadCount <= 0)
+        threadCount = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (threadCount <= 0)
+        threadCount = 1;
+    if (threadCount > instanceCount)
+        threadCount = instanceCount;
+
+    SimBatch *batch = calloc(1, sizeof(SimBatch));
+    if (batch == NULL)
+        return NULL;
+
+    batch->instanceCount = instanceCount;
+    batch->threadCount = threadCount;
+    batch->instances = calloc(instanceCount, sizeof(SimInstance));
+    batch->workers = calloc(threadCount, sizeof(struct SimWorker));
+    if (batch->instances == NULL || batch->workers == NULL)
+    {
+        free(batch->instances);
+        free(batch->workers);
+        free(batch);
+        return NULL;
+    }
+
+    SimBatchReset(batch);
+
+    for (int w = 0; w < threadCount; w++)
+        batch->workers[w].batch = batch;
+
+    pthread_mutex_init(&batch->setup, NULL);
+    pthread_mutex_lock(&batch->setup);
+
+    for (int w = 1; w < threadCount; w++)
+    {
+        if (pthread_create(&batch->workers[w].thread, NULL, SimWorkerMain, &batch->workers[w]) != 0)
+        {
+            threadCount = w; // make do with what we got
+            break;
+        }
+    }
+    batch->threadCount = threadCount;
+
+    // split instances as evenly as we can, the first few get one extra.
+    // the workers only read this once setup is unlocked
+    int at = 0;
+    for (int w = 0; w < threadCount; w++)
+    {
+        int count = instanceCount / threadCount + (w < instanceCount % threadCount ? 1 : 0);
+        batch->workers[w].first = at;
+        batch->workers[w].count = count;
+        at += count;
+    }
+
+    bool startOk = pthread_barrier_init(&batch->start, NULL, threadCount) == 0;
+    bool doneOk = pthread_barrier_init(&batch->done, NULL, threadCount) == 0;
+    if (!startOk || !doneOk)
+    {
+        // workers see quit as soon as they get the lock and leave
+        batch->quit = true;
+        pthread_mutex_unlock(&batch->setup);
+        for (int w = 1; w < threadCount; w++)
+            pthread_join(batch->workers[w].thread, NULL);
+
+        if (startOk)
+            pthread_barrier_destroy(&batch->start);
+        if (doneOk)
+            pthread_barrier_destroy(&batch->done);
+        pthread_mutex_destroy(&batch->setup);
+        free(batch->instances);
+        free(batch->workers);
+        free(batch);
+        return NULL;
+    }
+
+    pthread_mutex_unlock(&batch->setup);
+
+    return batch;
+}
+
+void SimBatchDestroy(SimBatch *batch)
+{
+    if (batch == NULL)
+        return;
+
+    if (batch->threadCount > 1)
+    {
+        batch->quit = true;
+        pthread_barrier_wait(&batch->start);
+        for (int w = 1; w < batch->threadCount; w++)
+            pthread_join(batch->workers[w].thread, NULL);
+    }
+
+    pthread_barrier_destroy(&batch->start);
+    pthread_barrier_destroy(&batch->done);
+    pthread_mutex_destroy(&batch->setup);
+    free(batch->instances);
+    free(batch->workers);
+    free(batch);
+}
+
+void SimBatchReset(SimBatch *batch)
+{
+    for (int i = 0; i < batch->instanceCount; i++)
+    {
+        InitWorld(&batch->instances[i].world);
+        InitPlayer(&batch->instances[i].player);
+    }
+}
+
+int SimBatchInstanceCount(const SimBatch *batch)
+{
+    return batch->instanceCount;
+}
+
+int SimBatchItemCount(const SimBatch *batch)
+{
+    return WorldItemCount();
+}
+
+int SimBatchItemStates(const SimBatch *batch, int instance, SimItemState *items, int maxItems)
+{
+    if (instance < 0 || instance >= batch->instanceCount)
+        return 0;
+
+    const World *world = &batch->instances[instance].world;
+    int count = WorldItemCount();
+    if (count > maxItems)
+        count = maxItems;
+
+    for (int i = 0; i < count; i++)
+    {
+        const EnvItem *ei = &world->items[i];
+        items[i].level = WorldItemLevel(i);
+        items[i].x = ei->rect.x;
+        items[i].y = ei->rect.y;
+        items[i].keyTaken = ei->isKeyTaken;
+        items[i].doorOpen = ei->isDoorOpen;
+    }
+
+    return count;
+}
+
+void SimBatchStep(SimBatch *batch, const unsigned char *inputs, int ticks, float delta, SimState *states)
+{
+    if (ticks < 0)
+        return;
+
+    batch->inputs = inputs;
+    batch->ticks = ticks;
+    batch->delta = delta;
+    batch->states = states;
+
+    if (batch->threadCount > 1)
+        pthread_barrier_wait(&batch->start);
+
+    SimRunShard(batch, batch->workers[0].first, batch->workers[0].count);
+
+    if (batch->threadCount > 1)
+        pthread_barrier_wait(&batch->done);
+}
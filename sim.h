@@ -0,0 +1,72 @@
+#ifndef SIM_H
+#define SIM_H
+
+// Headless batch simulation, for play-testing and level checking without a
+// window. A batch holds N independent games (player + world) stored back to
+// back and steps them all in lockstep, split across worker threads.
+//
+//     SimBatch *batch = SimBatchCreate(4096, 0);
+//     SimBatchStep(batch, inputs, 1, 1.0f / 60.0f, states);
+//     SimBatchDestroy(batch);
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// one byte of input per instance per tick
+enum
+{
+    SIM_INPUT_LEFT = 1 << 0,
+    SIM_INPUT_RIGHT = 1 << 1,
+    SIM_INPUT_JUMP = 1 << 2,
+    SIM_INPUT_USE = 1 << 3 // acts like use was pressed that tick
+};
+
+typedef struct SimState
+{
+    float x, y;
+    float speed;
+    int canJump;
+    int keys;
+    int level;
+    int direction;
+} SimState;
+
+// one level item, see SimBatchItemStates
+typedef struct SimItemState
+{
+    int level;
+    float x, y; // moves for items with gravity, like keys
+    int keyTaken;
+    int doorOpen;
+} SimItemState;
+
+typedef struct SimBatch SimBatch;
+
+// threadCount <= 0 uses one thread per online cpu. Returns NULL on failure
+SimBatch *SimBatchCreate(int instanceCount, int threadCount);
+void SimBatchDestroy(SimBatch *batch);
+
+// put every instance back at the start of the first level
+void SimBatchReset(SimBatch *batch);
+int SimBatchInstanceCount(const SimBatch *batch);
+
+// items of every level, the same for all instances
+int SimBatchItemCount(const SimBatch *batch);
+
+// Copies up to maxItems item states of one instance, every level back to
+// back in level order. Returns how many were written. Call between steps.
+int SimBatchItemStates(const SimBatch *batch, int instance, SimItemState *items, int maxItems);
+
+// Runs ticks updates of every instance with a fixed delta.
+// inputs is ticks * instanceCount bytes, tick major: inputs[t * instanceCount + i]
+// states gets instanceCount entries as of the last tick, may be NULL
+// ticks may be 0 to only read the current states, inputs isnt touched then
+void SimBatchStep(SimBatch *batch, const unsigned char *inputs, int ticks, float delta, SimState *states);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif